@@ -89,6 +89,7 @@
 #define CONFIG_USB
 #define CONFIG_STREAM_USB
 #define CONFIG_USB_UPDATE
+#define CONFIG_USB_UPDATE_WINDOW 8
 
 #undef CONFIG_UPDATE_PDU_SIZE
 #ifdef BOARD_WAND
@@ -233,6 +234,8 @@
 #define CONFIG_SPI_MASTER
 #define CONFIG_SPI_HALFDUPLEX
 #define CONFIG_STM32_SPI1_MASTER
+/* Sleep through heat map frame reads rather than polling the DMA */
+#define CONFIG_SPI_MASTER_DMA_SLEEP
 #define CONFIG_SPI_TOUCHPAD_PORT 0
 #define SPI_ST_TP_DEVICE_ID 0
 /* Enable SPI master xfer command */
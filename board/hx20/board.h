@@ -364,6 +364,9 @@
 #define EC_PS_ENTER_S0ix		BIT(6)
 #define EC_PS_RESUME_S0ix		BIT(7)
 
+/* Seqlock-guarded snapshot at EC_CUSTOMER_MEMMAP_TELEMETRY */
+#define CONFIG_HOST_TELEMETRY
+
 #endif
 
 /*
@@ -396,6 +399,7 @@
 #define CONFIG_FAN_INIT_SPEED 15
 #define FAN_HARDARE_MAX 7100
 #define CONFIG_TEMP_SENSOR
+#define CONFIG_TEMP_SENSOR_CACHE
 #define CONFIG_DPTF
 #define CONFIG_TEMP_SENSOR_F75303
 #define F75303_I2C_ADDR_FLAGS 0x4D
@@ -410,6 +414,7 @@
 #define CONFIG_PECI
 #define CONFIG_PECI_COMMON
 #define CONFIG_PECI_TJMAX 100
+#define CONFIG_PECI_TEMP_CACHE
 
 /* SPI Accelerometer
  * CONFIG_SPI_FLASH_PORT is the index into
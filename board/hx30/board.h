@@ -376,6 +376,9 @@
 #define EC_PS_ENTER_S0ix		BIT(6)
 #define EC_PS_RESUME_S0ix		BIT(7)
 
+/* Seqlock-guarded snapshot at EC_CUSTOMER_MEMMAP_TELEMETRY */
+#define CONFIG_HOST_TELEMETRY
+
 #endif
 
 /*
@@ -408,6 +411,7 @@
 #define CONFIG_FAN_INIT_SPEED 15
 #define FAN_HARDARE_MAX 7100
 #define CONFIG_TEMP_SENSOR
+#define CONFIG_TEMP_SENSOR_CACHE
 #define CONFIG_DPTF
 #define CONFIG_TEMP_SENSOR_F75303
 #define CONFIG_TEMP_SENSOR_F75397
@@ -423,6 +427,7 @@
 #define CONFIG_PECI
 #define CONFIG_PECI_COMMON
 #define CONFIG_PECI_TJMAX 100
+#define CONFIG_PECI_TEMP_CACHE
 
 
 #define CONFIG_CMD_ACCELS
@@ -14,6 +14,7 @@ board-y=board.o fpsensor_detect.o
 
 test-list-y=\
        aes \
+       benchmark \
        compile_time_macros \
        crc32 \
        flash_physical \
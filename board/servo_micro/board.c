@@ -60,6 +60,8 @@ void board_config_pre_init(void)
 
 #define USB_STREAM_RX_SIZE	32
 #define USB_STREAM_TX_SIZE	64
+/* Longest a partial packet of console output waits to go to the host */
+#define USART_TO_USB_FLUSH_US	(2 * MSEC)
 
 /******************************************************************************
  * Forward USART2 (EC) as a simple USB serial interface.
@@ -68,8 +70,12 @@ void board_config_pre_init(void)
 static struct usart_config const usart2;
 struct usb_stream_config const usart2_usb;
 
-static struct queue const usart2_to_usb = QUEUE_DIRECT(1024, uint8_t,
-	usart2.producer, usart2_usb.consumer);
+static struct queue const usart2_to_usb;
+DECLARE_QUEUE_WATERMARK_FLUSH(usart2_to_usb);
+static struct queue const usart2_to_usb = QUEUE_WATERMARK(1024, uint8_t,
+	usart2.producer, usart2_usb.consumer,
+	0, USB_STREAM_TX_SIZE, USART_TO_USB_FLUSH_US,
+	&usart2_to_usb_flush_data);
 static struct queue const usb_to_usart2 = QUEUE_DIRECT(64, uint8_t,
 	usart2_usb.producer, usart2.consumer);
 
@@ -103,8 +109,12 @@ USB_STREAM_CONFIG_USART_IFACE(usart2_usb,
 static struct usart_config const usart3;
 struct usb_stream_config const usart3_usb;
 
-static struct queue const usart3_to_usb = QUEUE_DIRECT(1024, uint8_t,
-	usart3.producer, usart3_usb.consumer);
+static struct queue const usart3_to_usb;
+DECLARE_QUEUE_WATERMARK_FLUSH(usart3_to_usb);
+static struct queue const usart3_to_usb = QUEUE_WATERMARK(1024, uint8_t,
+	usart3.producer, usart3_usb.consumer,
+	0, USB_STREAM_TX_SIZE, USART_TO_USB_FLUSH_US,
+	&usart3_to_usb_flush_data);
 static struct queue const usb_to_usart3 = QUEUE_DIRECT(64, uint8_t,
 	usart3_usb.producer, usart3.consumer);
 
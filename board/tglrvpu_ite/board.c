@@ -192,8 +192,7 @@ __override void bb_retimer_power_handle(const struct usb_mux *me, int on_off)
 		msleep(10);
 		gpio_set_level(force_power_gpio, 1);
 
-		/* Allow 20ms time for the retimer to be initialized. */
-		msleep(20);
+		bb_retimer_wait_ready(me);
 
 		mutex_unlock(&bb_nvm_mutex);
 	} else {
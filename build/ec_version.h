@@ -0,0 +1,12 @@
+/* This file is generated by util/getversion.sh */
+#define CROS_EC_VERSION32 "_v0.0.148+e9af6eb"
+/* Version string for ectool. */
+#define CROS_ECTOOL_VERSION "v0.0.148+e9af6eb"
+/* Version string for stm32mon. */
+#define CROS_STM32MON_VERSION "v0.0.148+e9af6eb"
+/* Sub-fields for use in Makefile.rules and to form build info string
+ * in common/version.c. */
+#define VERSION "_v0.0.148+e9af6eb"
+#define BUILDER "@vm"
+/* Repo is dirty, using time of most recent file modification. */
+#define DATE "2026-10-14 12:08:34"
@@ -0,0 +1,12 @@
+/* This file is generated by util/getversion.sh */
+#define CROS_EC_VERSION32 "host_v0.0.138+759929c"
+/* Version string for ectool. */
+#define CROS_ECTOOL_VERSION "v0.0.138+759929c"
+/* Version string for stm32mon. */
+#define CROS_STM32MON_VERSION "v0.0.138+759929c"
+/* Sub-fields for use in Makefile.rules and to form build info string
+ * in common/version.c. */
+#define VERSION "host_v0.0.138+759929c"
+#define BUILDER "@vm"
+/* Repo is dirty, using time of most recent file modification. */
+#define DATE "2026-10-14 11:39:44"
@@ -0,0 +1,12 @@
+/* This file is generated by util/getversion.sh */
+#define CROS_EC_VERSION32 "host_v0.0.52-670e023"
+/* Version string for ectool. */
+#define CROS_ECTOOL_VERSION "v0.0.52-670e023"
+/* Version string for stm32mon. */
+#define CROS_STM32MON_VERSION "v0.0.52-670e023"
+/* Sub-fields for use in Makefile.rules and to form build info string
+ * in common/version.c. */
+#define VERSION "host_v0.0.52-670e023"
+#define BUILDER "@vm"
+/* Repo is clean, use the commit date of the last commit. */
+#define DATE "2026-10-14 08:13:48"